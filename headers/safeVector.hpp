@@ -0,0 +1,70 @@
+#ifndef SAFE_VECTOR_HPP
+#define SAFE_VECTOR_HPP
+
+#include <utility>
+#include "vector.hpp"
+
+// RAII owner of a Vector. Moves hand the buffer over without allocating or copying elements,
+// a moved-from SafeVector owns nothing and is constructed again on the next push
+class SafeVector final
+{
+public:
+    SafeVector() : vec_() { vectorCtor(&vec_); }
+    ~SafeVector()         { vectorDtor(&vec_); }
+
+    SafeVector(const SafeVector&)            = delete;
+    SafeVector& operator=(const SafeVector&) = delete;
+
+    SafeVector(SafeVector&& other) noexcept : vec_() { vectorMove(&vec_, &other.vec_); }
+
+    SafeVector& operator=(SafeVector&& other) noexcept
+    {
+        vectorMove(&vec_, &other.vec_);
+        return *this;
+    }
+
+    void swap(SafeVector& other) noexcept { vectorSwap(&vec_, &other.vec_); }
+
+    VectorError push_back(VectorElem_t value)
+    {
+        if (!vec_.data)
+            vectorCtor(&vec_);
+
+        return vectorPush(&vec_, value);
+    }
+
+    template <typename... Args>
+    VectorError emplace_back(Args&&... args)
+    {
+        VectorElem_t value = {std::forward<Args>(args)...}; // only implicit conversions
+        return push_back(value);
+    }
+
+    VectorElem_t pop_back() { return vectorPop(&vec_); }
+
+    VectorElem_t operator[](size_t index) const { return vectorGet(&vec_, index); }
+
+    size_t size()     const { return vec_.size;     }
+    size_t capacity() const { return vec_.data ? vec_.capacity - 2 : 0; } // -2 for canaries
+
+    bool   contains(VectorElem_t value) const { return vectorContains(&vec_, value); }
+    size_t indexOf (VectorElem_t value) const { return vectorIndexOf (&vec_, value); }
+
+    // see vectorRelease
+    VectorError release(VectorElem_t** data, size_t* size, size_t* capacity) { return vectorRelease(&vec_, data, size, capacity); }
+
+    // see vectorAdopt
+    VectorError adopt(VectorElem_t* data, size_t size, size_t capacity) { return vectorAdopt(&vec_, data, size, capacity); }
+
+    Vector*       get()       { return &vec_; }
+    const Vector* get() const { return &vec_; }
+
+    void dump() const { vectorDump(&vec_); }
+
+private:
+    Vector vec_;
+};
+
+inline void swap(SafeVector& a, SafeVector& b) noexcept { a.swap(b); }
+
+#endif
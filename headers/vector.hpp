@@ -1,14 +1,13 @@
 #ifndef STACK_MAIN_H
 #define STACK_MAIN_H
 
-typedef void* Canary_t;
-typedef void* VectorElem_t;
-
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <stdint.h>
 #include "configFile.hpp"
+#include "vectorTypes.hpp"
+#include "vectorIndex.hpp"
 
 #ifdef VECTOR_DEBUG
     #define V_DBG(...) __VA_ARGS__
@@ -38,6 +37,9 @@ struct Vector
     void** data;
     size_t       size;
     size_t       capacity;
+    size_t       highWater; // data[highWater + 1 .. capacity - 2] are POISON logically and never written
+
+    VectorIndex* index;     // optional value -> position index, nullptr if disabled
 
     #ifdef VECTOR_HASH_PROTECTION
     uint64_t dataHashSum;
@@ -62,6 +64,7 @@ enum VectorError
     DATA_HASH_ERROR          = 1 << 9,
     INIT_HASH_ERROR          = 1 << 10,   
     INDEX_OUT_OF_RANGE       = 1 << 11,
+    INDEX_ERROR              = 1 << 12,
     NUMBER_OF_ERRORS
 };
 
@@ -69,6 +72,7 @@ const size_t       START_SIZE       = 16;
 const VectorElem_t POISON           = (VectorElem_t)-666;
 const size_t       REDUCER_CAPACITY = 2;
 const uint64_t     HASH_COEFF       = 33;
+const size_t       INDEX_NOT_FOUND  = (size_t)-1;
 
 const Canary_t L_DATA_KANAR  = (void*)0xEDAA;
 const Canary_t R_DATA_KANAR  = (void*)0xF00D;
@@ -82,9 +86,28 @@ VectorError  vectorPush(Vector* vec, VectorElem_t value);
 VectorElem_t vectorPop (Vector* vec);
 VectorElem_t vectorGet (const Vector* vec, const size_t index);
 
+// dst and vec must be zero-initialized or constructed, their old contents are destroyed first
+// (unless dst is a bitwise copy of src, then dst just takes src over).
+// vectorMove and vectorRelease hand the buffer over even if verification fails, the error is returned.
+// vectorRelease gives the buffer (elements in data[1 .. size]) to the caller, who must free() it.
+// vectorAdopt takes a malloc'ed buffer in the same layout without copying, on failure it stays with the caller.
+// Adopting the buffer vec already owns is rejected with POINTER_ERROR.
+VectorError vectorMove   (Vector* dst, Vector* src);
+VectorError vectorSwap   (Vector* a,   Vector* b);
+VectorError vectorRelease(Vector* vec, VectorElem_t** data, size_t* size, size_t* capacity);
+VectorError vectorAdopt  (Vector* vec, VectorElem_t* data, size_t size, size_t capacity);
+
+VectorError vectorIndexCtor(Vector* vec);
+VectorError vectorIndexDtor(Vector* vec);
+
+bool        vectorContains   (const Vector* vec, VectorElem_t value);
+size_t      vectorIndexOf    (const Vector* vec, VectorElem_t value);
+VectorError vectorPushUnique (Vector* vec, VectorElem_t value);
+size_t      vectorIndexMemory(const Vector* vec);
+
 uint64_t vectorVerify(Vector* vec);
 
-void        vectorDump     (const Vector vec);
-VectorError vectorErrorDump(const Vector vec);
+void        vectorDump     (const Vector* vec);
+VectorError vectorErrorDump(const Vector* vec);
 
 #endif
@@ -0,0 +1,38 @@
+#ifndef VECTOR_INDEX_HPP
+#define VECTOR_INDEX_HPP
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "vectorTypes.hpp"
+
+struct VectorIndexEntry
+{
+    VectorElem_t key;
+    size_t       firstPos;  // smallest position of key in the vector
+    size_t       count;     // number of occurrences, 0 marks a free slot
+};
+
+struct VectorIndex
+{
+    VectorIndexEntry* entries;   // open addressing table with linear probing
+    size_t            capacity;  // always a power of two
+    size_t            used;      // number of distinct keys
+    size_t            elemCount; // total number of occurrences, must be equal to vec->size
+};
+
+const size_t INDEX_START_SIZE = 16;
+const size_t INDEX_LOAD_NUM   = 3;   // table grows when used / capacity
+const size_t INDEX_LOAD_DEN   = 4;   // would exceed INDEX_LOAD_NUM / INDEX_LOAD_DEN
+
+bool indexCtor   (VectorIndex* idx, size_t keys);
+void indexDtor   (VectorIndex* idx);
+bool indexReserve(VectorIndex* idx, size_t keys);
+
+void indexInsert(VectorIndex* idx, VectorElem_t key, size_t pos);
+void indexErase (VectorIndex* idx, VectorElem_t key);
+
+const VectorIndexEntry* indexFind(const VectorIndex* idx, VectorElem_t key);
+
+size_t indexMemory(const VectorIndex* idx);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef VECTOR_TYPES_HPP
+#define VECTOR_TYPES_HPP
+
+typedef void* Canary_t;
+typedef void* VectorElem_t;
+
+#endif
@@ -1,4 +1,5 @@
 #include "../headers/vector.hpp"
+#include "../headers/safeVector.hpp"
 
 int main()
 {
@@ -10,7 +11,14 @@ int main()
 
     printf("%p\n", vectorGet(&vec, 3));
 
-    vectorDump(vec);
+    vectorDump(&vec);
     vectorDtor(&vec);
+
+    SafeVector first;
+    for (int i = 1; i < 8; i++)
+        first.emplace_back((VectorElem_t)(uintptr_t)i);
+
+    SafeVector second = std::move(first); // the buffer is handed over, no elements are copied
+    second.dump();
     return 0;
 }
\ No newline at end of file
@@ -3,7 +3,10 @@
 #include <math.h>
 #include <inttypes.h>
 
-static void vectorDataDump(Vector vec);
+static void vectorDataDump (const Vector* vec);
+static void vectorIndexFree(Vector* vec);
+static VectorError vectorCheck(Vector* vec);
+static void        vectorSeal (Vector* vec);
 
 #ifdef VECTOR_CANARY_PROTECTION
 static void installDataCanaries (Vector* vec);
@@ -13,7 +16,9 @@ static void removeVectorCanaries (Vector* vec);
 #endif
 
 #ifdef VECTOR_HASH_PROTECTION
-static uint64_t vectorDataHashCalc  (const char* start, const char* end);
+static uint64_t vectorBytesHashCalc (uint64_t hashSum, const char* start, const char* end);
+static uint64_t vectorPoisonHashCalc(uint64_t hashSum, size_t count);
+static uint64_t vectorDataHashCalc  (const Vector* vec);
 static uint64_t vectorStructHashCalc(const Vector* vec); 
 #endif
 
@@ -23,8 +28,8 @@ do                                                                         \
     if (verifyError != OK)                                                 \
     {                                                                      \
         V_DBG(fprintf(stderr, RED "Error: verifyError != OK\n" RESET);)    \
-        vectorDump(*vec);                                                  \
-        vectorErrorDump(*vec);                                             \
+        vectorDump(vec);                                                   \
+        vectorErrorDump(vec);                                              \
         __VA_ARGS__                                                        \
     }                                                                      \
 } while (0)          
@@ -64,13 +69,12 @@ static void removeVectorCanaries(Vector* vec)
 #endif
 
 #ifdef VECTOR_HASH_PROTECTION
-static uint64_t vectorDataHashCalc(const char* start, const char* end)
+static uint64_t vectorBytesHashCalc(uint64_t hashSum, const char* start, const char* end)
 {
     V_DBG(ASSERT(start, "start = nulptr", stderr);)
     V_DBG(ASSERT(end,   "end = nulptr", stderr);)
     V_DBG(bool check = end > start; ASSERT(check, "end > start", stderr);)
 
-    uint64_t hashSum = 5381;
     char* current = const_cast<char*>(start);
     while (current < end)
     {
@@ -80,6 +84,48 @@ static uint64_t vectorDataHashCalc(const char* start, const char* end)
     return hashSum;
 }
 
+static uint64_t vectorPoisonHashCalc(uint64_t hashSum, size_t count)
+{
+    // One POISON slot maps hashSum to mul * hashSum + add, so count slots are hashed by squaring,
+    // with the same result as hashing them byte by byte
+    const VectorElem_t   poison = POISON;
+    const unsigned char* bytes  = reinterpret_cast<const unsigned char*>(&poison);
+
+    uint64_t mul = 1;
+    uint64_t add = 0;
+    for (size_t i = 0; i < sizeof(poison); i++)
+    {
+        mul = mul * (HASH_COEFF + 1);
+        add = add * (HASH_COEFF + 1) + bytes[i];
+    }
+
+    while (count)
+    {
+        if (count & 1)
+            hashSum = hashSum * mul + add;
+
+        add   = add * mul + add;
+        mul   = mul * mul;
+        count >>= 1;
+    }
+    return hashSum;
+}
+
+static uint64_t vectorDataHashCalc(const Vector* vec)
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    const char* data = reinterpret_cast<const char*>(vec->data);
+    const char* last = reinterpret_cast<const char*>(vec->data + vec->capacity - 1);
+
+    uint64_t hashSum = 5381;
+    hashSum = vectorBytesHashCalc (hashSum, data, reinterpret_cast<const char*>(vec->data + vec->highWater + 1));
+    hashSum = vectorPoisonHashCalc(hashSum, vec->capacity - 2 - vec->highWater);  // logical POISON slots
+    hashSum = vectorBytesHashCalc (hashSum, last, last + sizeof(VectorElem_t));    // right canary slot
+
+    return hashSum;
+}
+
 static uint64_t vectorStructHashCalc(const Vector* vec) 
 {
     V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
@@ -110,6 +156,7 @@ void vectorCtor(Vector* vec)
     vec->coefCapacity = 2;
     vec->size = 0;
     vec->capacity = START_SIZE;
+    vec->highWater = 0;
 
     vec->data = (VectorElem_t*)calloc(vec->capacity, sizeof(VectorElem_t));
     if (!vec->data)
@@ -118,14 +165,10 @@ void vectorCtor(Vector* vec)
         return;
     }
 
-    V_CAN_PR(installDataCanaries(vec);)
-
-    for (size_t i = 1; i < vec->capacity - 1; i++) 
-        vec->data[i] = POISON;
+    V_CAN_PR(installDataCanaries(vec);) // slots after highWater are POISON logically, they are not written
 
     #ifdef VECTOR_HASH_PROTECTION
-    vec->dataHashSum   = vectorDataHashCalc(reinterpret_cast<const char*>(vec->data), 
-                                            reinterpret_cast<const char*>(vec->data + vec->capacity));
+    vec->dataHashSum   = vectorDataHashCalc(vec);
     vec->vectorHashSum = vectorStructHashCalc(vec);
     #endif
 
@@ -133,16 +176,32 @@ void vectorCtor(Vector* vec)
     if (verifyError != OK)
     {
         vec->errorStatus |= INIT_HASH_ERROR;
-        vectorDump(*vec);
-        vectorErrorDump(*vec);
+        vectorDump(vec);
+        vectorErrorDump(vec);
     }
 }
 
+static void vectorIndexFree(Vector* vec) // no verification, the caller drops the whole structure
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec->index)
+        return;
+
+    indexDtor(vec->index);
+    FREE(vec->index);
+}
+
 void vectorDtor(Vector* vec)
 {
     V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
 
-    V_CAN_PR(removeDataCanaries(vec);)
+    vectorIndexFree(vec);
+
+    if (vec->data) // a moved-from or released vector owns nothing
+    {
+        V_CAN_PR(removeDataCanaries(vec);)
+    }
     
     FREE(vec->data);
     
@@ -152,6 +211,137 @@ void vectorDtor(Vector* vec)
     memset(vec, 0, sizeof(*vec));
 }
 
+static VectorError vectorCheck(Vector* vec) // a vector that owns nothing has nothing to check
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec->data)
+        return OK;
+
+    VectorError verifyError = (VectorError)vectorVerify(vec);
+    VERIFICATION(return verifyError;);
+
+    return OK;
+}
+
+static void vectorSeal(Vector* vec) // only for a verified vector, the buffer is untouched
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec->data)
+        return;
+
+    V_CAN_PR(installVectorCanaries(vec);)
+    V_HASH_PR(vec->vectorHashSum = vectorStructHashCalc(vec);)
+}
+
+VectorError vectorMove(Vector* dst, Vector* src)
+{
+    V_DBG(ASSERT(dst, "dst = nullptr", stderr);)
+    V_DBG(ASSERT(src, "src = nullptr", stderr);)
+
+    if (!dst || !src)
+        return POINTER_ERROR;
+
+    if (dst == src)
+        return OK;
+
+    VectorError verifyError = vectorCheck(src);
+
+    bool aliased = (dst->data  && dst->data  == src->data) ||   // dst is a bitwise copy of src,
+                   (dst->index && dst->index == src->index);    // it owns nothing of its own
+    if (!aliased)
+        vectorDtor(dst);
+
+    memcpy(dst, src, sizeof(*dst));  // the buffer and the index are handed over even if src is broken
+    memset(src, 0, sizeof(*src));    // src is left in the same state as after vectorDtor
+
+    if (verifyError == OK)           // a broken vector stays broken for the new owner
+        vectorSeal(dst);
+
+    return verifyError;
+}
+
+VectorError vectorSwap(Vector* a, Vector* b)
+{
+    V_DBG(ASSERT(a, "a = nullptr", stderr);)
+    V_DBG(ASSERT(b, "b = nullptr", stderr);)
+
+    if (!a || !b)
+        return POINTER_ERROR;
+
+    VectorError errorA = vectorCheck(a);
+    VectorError errorB = vectorCheck(b);
+
+    Vector tmp = *a;
+    *a = *b;
+    *b = tmp;
+
+    if (errorA == OK)
+        vectorSeal(b);
+    if (errorB == OK)
+        vectorSeal(a);
+
+    return (VectorError)(errorA | errorB);
+}
+
+VectorError vectorRelease(Vector* vec, VectorElem_t** data, size_t* size, size_t* capacity)
+{
+    V_DBG(ASSERT(vec,      "vec = nullptr",      stderr);)
+    V_DBG(ASSERT(data,     "data = nullptr",     stderr);)
+    V_DBG(ASSERT(size,     "size = nullptr",     stderr);)
+    V_DBG(ASSERT(capacity, "capacity = nullptr", stderr);)
+
+    if (!vec || !data || !size || !capacity)
+        return POINTER_ERROR;
+
+    VectorError verifyError = vectorCheck(vec);
+
+    vectorIndexFree(vec);
+
+    *data     = vec->data;             // the buffer is handed over even if vec is broken
+    *size     = vec->size;
+    *capacity = vec->capacity;
+
+    memset(vec, 0, sizeof(*vec));
+    return verifyError;
+}
+
+VectorError vectorAdopt(Vector* vec, VectorElem_t* data, size_t size, size_t capacity)
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec || !data)
+        return POINTER_ERROR;
+
+    if (data == vec->data) // the buffer is already owned by vec
+        return POINTER_ERROR;
+
+    if (capacity < 2 || size > capacity - 2) // -2 for canaries
+        return SIZE_ERROR;
+
+    vectorDtor(vec); // arguments are checked, so the old contents can go
+
+    vec->coefCapacity = 2;
+    vec->data         = data;
+    vec->size         = size;
+    vec->capacity     = capacity;
+    vec->highWater    = size;  // the rest of the buffer is POISON logically
+
+    V_CAN_PR(installVectorCanaries(vec);)
+    V_CAN_PR(installDataCanaries(vec);)
+
+    #ifdef VECTOR_HASH_PROTECTION
+    vec->dataHashSum   = vectorDataHashCalc(vec);
+    vec->vectorHashSum = vectorStructHashCalc(vec);
+    #endif
+
+    VectorError verifyError = (VectorError)vectorVerify(vec);
+    VERIFICATION(memset(vec, 0, sizeof(*vec)); return verifyError;); // the buffer stays with the caller
+
+    return OK;
+}
+
 VectorError vectorPush(Vector* vec, VectorElem_t value)
 {
     V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
@@ -162,6 +352,13 @@ VectorError vectorPush(Vector* vec, VectorElem_t value)
     VectorError verifyError = (VectorError)vectorVerify(vec);
     VERIFICATION(return verifyError;);
 
+    if (vec->index && !indexReserve(vec->index, vec->index->used + 1)) // reserve first so that nothing changes on failure
+    {
+        vec->errorStatus |= ALLOC_ERROR;
+        V_HASH_PR(vec->vectorHashSum = vectorStructHashCalc(vec);)
+        return ALLOC_ERROR;
+    }
+
     if (vec->size >= vec->capacity - 2) // CHECKING FOR IMPLEMENTATION
     {    
         V_CAN_PR(removeDataCanaries(vec);)
@@ -175,8 +372,7 @@ VectorError vectorPush(Vector* vec, VectorElem_t value)
             vec->errorStatus |= ALLOC_ERROR;
 
             #ifdef VECTOR_HASH_PROTECTION
-                vec->dataHashSum  = vectorDataHashCalc(reinterpret_cast<char*>(vec->data), 
-                                                       reinterpret_cast<char*>(vec->data + vec->capacity));
+                vec->dataHashSum  = vectorDataHashCalc(vec);
                 vec->vectorHashSum = vectorStructHashCalc(vec);
             #endif
 
@@ -184,10 +380,7 @@ VectorError vectorPush(Vector* vec, VectorElem_t value)
         }
 
         vec->data = (VectorElem_t*)newData;
-        vec->capacity = newCapacity;
-        
-        for (size_t i = vec->size + 1; i < vec->capacity - 1; i++) // Initialize new memory
-            vec->data[i] = POISON;
+        vec->capacity = newCapacity;  // new memory stays POISON logically (after highWater)
 
         V_CAN_PR(installDataCanaries(vec);)
     }    
@@ -195,9 +388,14 @@ VectorError vectorPush(Vector* vec, VectorElem_t value)
     vec->size++;
     vec->data[vec->size] = value;
 
+    if (vec->size > vec->highWater) // the slot is materialized now
+        vec->highWater = vec->size;
+
+    if (vec->index)
+        indexInsert(vec->index, value, vec->size - 1);
+
     #ifdef VECTOR_HASH_PROTECTION
-    vec->dataHashSum  = vectorDataHashCalc(reinterpret_cast<const char*>(vec->data), 
-                                           reinterpret_cast<const char*>(vec->data + vec->capacity));
+    vec->dataHashSum  = vectorDataHashCalc(vec);
     vec->vectorHashSum = vectorStructHashCalc(vec);
     #endif
 
@@ -222,7 +420,7 @@ VectorElem_t vectorPop(Vector* vec)
     {
         V_DBG(fprintf(stderr, RED "Error: stack is empty\n" RESET);)
         vec->errorStatus |= EMPTY_VECTOR;
-        vectorErrorDump(*vec);
+        vectorErrorDump(vec);
         return POISON;
     }
     
@@ -230,6 +428,9 @@ VectorElem_t vectorPop(Vector* vec)
     vec->data[vec->size] = POISON;   
     vec->size--;
 
+    if (vec->index)
+        indexErase(vec->index, temp);
+
     if (vec->size < vec->capacity / (REDUCER_CAPACITY * vec->coefCapacity) && vec->capacity > START_SIZE)
     {
         V_CAN_PR(removeDataCanaries(vec);)
@@ -246,8 +447,7 @@ VectorElem_t vectorPop(Vector* vec)
             V_CAN_PR(installDataCanaries(vec);)
 
             #ifdef VECTOR_HASH_PROTECTION
-                vec->dataHashSum   = vectorDataHashCalc(reinterpret_cast<char*>(vec->data), \
-                                                        reinterpret_cast<char*>(vec->data + vec->capacity));
+                vec->dataHashSum   = vectorDataHashCalc(vec);
                 vec->vectorHashSum = vectorStructHashCalc(vec);
             #endif
 
@@ -257,14 +457,16 @@ VectorElem_t vectorPop(Vector* vec)
         {
             vec->data = (VectorElem_t*)newData;
             vec->capacity = newCapacity;
+
+            if (vec->highWater > vec->capacity - 2)
+                vec->highWater = vec->capacity - 2;
             
             V_CAN_PR(installDataCanaries(vec);)
         }
     }
 
     #ifdef VECTOR_HASH_PROTECTION
-    vec->dataHashSum  = vectorDataHashCalc(reinterpret_cast<const char*>(vec->data), 
-                                           reinterpret_cast<const char*>(vec->data + vec->capacity));
+    vec->dataHashSum  = vectorDataHashCalc(vec);
     vec->vectorHashSum = vectorStructHashCalc(vec);
     #endif
 
@@ -301,8 +503,7 @@ VectorElem_t vectorGet(const Vector* vec, const size_t index)
     }
 
     #ifdef VECTOR_HASH_PROTECTION
-    uint64_t currentDataHash   = vectorDataHashCalc(reinterpret_cast<const char*>(vec->data), 
-                                                    reinterpret_cast<const char*>(vec->data + vec->capacity));
+    uint64_t currentDataHash   = vectorDataHashCalc(vec);
     uint64_t currentVectorHash = vectorStructHashCalc(vec);
     
     if (currentDataHash != vec->dataHashSum) 
@@ -323,17 +524,124 @@ VectorElem_t vectorGet(const Vector* vec, const size_t index)
     return vec->data[index + 1]; // +1 because of canary
 }
 
+VectorError vectorIndexCtor(Vector* vec)
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec)
+        return POINTER_ERROR;
+
+    VectorError verifyError = (VectorError)vectorVerify(vec);
+    VERIFICATION(return verifyError;);
+
+    if (vec->index) // already built
+        return OK;
+
+    VectorIndex* index = (VectorIndex*)calloc(1, sizeof(VectorIndex));
+    if (!index || !indexCtor(index, vec->size))
+    {
+        free(index);
+        vec->errorStatus |= ALLOC_ERROR;
+        V_HASH_PR(vec->vectorHashSum = vectorStructHashCalc(vec);)
+        return ALLOC_ERROR;
+    }
+
+    for (size_t i = 0; i < vec->size; i++) // indexCtor has already sized the table for vec->size keys
+        indexInsert(index, vec->data[i + 1], i);
+
+    vec->index = index;
+    V_HASH_PR(vec->vectorHashSum = vectorStructHashCalc(vec);)
+
+    return OK;
+}
+
+VectorError vectorIndexDtor(Vector* vec)
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec)
+        return POINTER_ERROR;
+
+    if (!vec->index)
+        return OK;
+
+    VectorError verifyError = (VectorError)vectorVerify(vec);
+    VERIFICATION(return verifyError;);
+
+    vectorIndexFree(vec);
+    V_HASH_PR(vec->vectorHashSum = vectorStructHashCalc(vec);)
+
+    return OK;
+}
+
+size_t vectorIndexOf(const Vector* vec, VectorElem_t value) // does not rehash the buffer, so O(1) with the index
+{
+    if (!vec || !vec->data) 
+    {
+        V_DBG(fprintf(stderr, RED "Error: nullptr passed to vectorIndexOf\n" RESET);)
+        return INDEX_NOT_FOUND;
+    }
+
+    if (vec->index)
+    {
+        const VectorIndexEntry* entry = indexFind(vec->index, value);
+        return entry ? entry->firstPos : INDEX_NOT_FOUND;
+    }
+
+    for (size_t i = 0; i < vec->size; i++) // no index: fall back to the linear scan
+    {
+        if (vec->data[i + 1] == value)
+            return i;
+    }
+
+    return INDEX_NOT_FOUND;
+}
+
+bool vectorContains(const Vector* vec, VectorElem_t value)
+{
+    return vectorIndexOf(vec, value) != INDEX_NOT_FOUND;
+}
+
+VectorError vectorPushUnique(Vector* vec, VectorElem_t value) // pushes only if value is not in the vector yet
+{
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
+    if (!vec)
+        return POINTER_ERROR;
+
+    if (vectorContains(vec, value))
+        return OK;
+
+    return vectorPush(vec, value);
+}
+
+size_t vectorIndexMemory(const Vector* vec)
+{
+    if (!vec)
+        return 0;
+
+    return indexMemory(vec->index);
+}
+
 #undef VERIFICATION
 
-static void vectorDataDump(const Vector vec)
+static void vectorDataDump(const Vector* vec)
 {
     printf(GREEN "{\n" RESET);
 
-    for (size_t i = 0; i < vec.capacity; ++i)
+    for (size_t i = 0; i < vec->capacity; ++i)
     {
+        if (i == vec->highWater + 1 && i < vec->capacity - 1) // logical POISON is not read
+        {
+            printf("  " GREEN "[" MANG "%3zu" GREEN " .. " MANG "%3zu" GREEN "] = " RED "<POISON>" RESET "\n",
+                   i, vec->capacity - 2);
+            i = vec->capacity - 2;
+            continue;
+        }
+
         printf("  " GREEN "[" MANG "%3zu" GREEN "] = ", i);
 
-        VectorElem_t val = vec.data[i];
+        VectorElem_t val = vec->data[i];
 
         if (val == POISON)
             printf(RED "<POISON>" RESET);
@@ -355,37 +663,47 @@ static void vectorDataDump(const Vector vec)
     #ifdef VECTOR_CANARY_PROTECTION
     printf(BLUE "vec.data" GREEN "[0]          = "RED"%p" GREEN
         " ; must be %p\n" RESET,
-        vec.data[0], L_DATA_KANAR);
+        vec->data[0], L_DATA_KANAR);
     printf(BLUE "vec.data" GREEN "[capacity-1] = " RED "%p" GREEN
         " ; must be %p\n" RESET,
-        vec.data[vec.capacity - 1], R_DATA_KANAR);
+        vec->data[vec->capacity - 1], R_DATA_KANAR);
     #endif
 }
 
-void vectorDump(const Vector vec)
+void vectorDump(const Vector* vec)
 {
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
     printf(RED  "___vectorDump____________________________________________________________\n" RESET);
 
     #ifdef VECTOR_CANARY_PROTECTION
     printf(GREEN "{ "
         BLUE  "L_STACK_CANARY" GREEN " = " RED "%p" GREEN ", "
         BLUE  "R_STACK_CANARY" GREEN " = " RED "%p" GREEN " }\n" RESET,
-        vec.leftVectorCanary, vec.rightVectorCanary);
+        vec->leftVectorCanary, vec->rightVectorCanary);
 
     printf(GREEN "{ "
         BLUE  "L_DATA_CANARY"  GREEN " = " RED "%p" GREEN ", "
         BLUE  "R_DATA_CANARY"  GREEN " = " RED "%p" GREEN " }\n" RESET,
-        vec.data ? vec.data[0] : nullptr,
-        vec.data ? vec.data[vec.capacity - 1] : nullptr);
+        vec->data ? vec->data[0] : nullptr,
+        vec->data ? vec->data[vec->capacity - 1] : nullptr);
     #endif
 
-    printf(BLUE "capacity" GREEN " = " RED "%zu" RESET ", "
-           BLUE "size"     GREEN " = " RED "%zu" RESET "\n",
-           vec.capacity, vec.size);
+    printf(BLUE "capacity"  GREEN " = " RED "%zu" RESET ", "
+           BLUE "size"      GREEN " = " RED "%zu" RESET ", "
+           BLUE "highWater" GREEN " = " RED "%zu" RESET "\n",
+           vec->capacity, vec->size, vec->highWater);
+
+    printf(CEAN "data" GREEN " [ " MANG "%p" GREEN " ]\n" RESET, vec->data);
 
-    printf(CEAN "data" GREEN " [ " MANG "%p" GREEN " ]\n" RESET, vec.data);
+    if (vec->index)
+        printf(CEAN "index" GREEN " [ " MANG "%p" GREEN " ] " 
+               BLUE "keys"   GREEN " = " RED "%zu" RESET ", "
+               BLUE "memory" GREEN " = " RED "%zu" GREEN " bytes\n" RESET,
+               vec->index, vec->index->used, vectorIndexMemory(vec));
 
-    vectorDataDump(vec);
+    if (vec->data)
+        vectorDataDump(vec);
 
     printf(RED "_________________________________________________________________________\n" RESET);
 }
@@ -402,6 +720,9 @@ uint64_t vectorVerify(Vector* vec)
 
     if (vec->size > vec->capacity - 2)  // -2 for canaries
         errors |= SIZE_ERROR;
+
+    if (vec->size > vec->highWater || vec->highWater > vec->capacity - 2)
+        errors |= SIZE_ERROR;
     
     #ifdef VECTOR_CANARY_PROTECTION
     if (vec->leftVectorCanary  != L_STACK_KANAR)
@@ -425,11 +746,13 @@ uint64_t vectorVerify(Vector* vec)
     }
     #endif
 
+    if (vec->index && vec->index->elemCount != vec->size)
+        errors |= INDEX_ERROR;
+
     #ifdef VECTOR_HASH_PROTECTION
     if (vec->data && vec->capacity > 0) // check data hash
     {
-        uint64_t currentDataHash = vectorDataHashCalc(reinterpret_cast<const char*>(vec->data), 
-                                                      reinterpret_cast<const char*>(vec->data + vec->capacity));
+        uint64_t currentDataHash = vectorDataHashCalc(vec);
         if (currentDataHash != vec->dataHashSum)
             errors |= DATA_HASH_ERROR;
     }
@@ -456,13 +779,17 @@ static const char* VectorErrors[NUMBER_OF_ERRORS] = {
                                                     "VECTOR_HASH_ERROR",
                                                     "DATA_HASH_ERROR",
                                                     "INIT_HASH_ERROR",   
+                                                    "INDEX_OUT_OF_RANGE",
+                                                    "INDEX_ERROR",
                                                    };
-VectorError vectorErrorDump(const Vector vec)
+VectorError vectorErrorDump(const Vector* vec)
 {
+    V_DBG(ASSERT(vec, "vec = nullptr", stderr);)
+
     printf("%s___vectorErrorDump___~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~%s\n", RED, RESET);
     for (size_t i = 0; i < NUMBER_OF_ERRORS; i++)
     {
-        if (vec.errorStatus & (1 << i))
+        if (vec->errorStatus & (1 << i))
             fprintf(stderr, RED"error: code %zu ( %s )\n"RESET, i + 1, VectorErrors[i]);
     }
     return OK;
@@ -0,0 +1,166 @@
+#include "../headers/vector.hpp"
+#include <myLib.hpp>
+
+static size_t indexHashCalc(VectorElem_t key);
+static size_t indexSlotFind(const VectorIndex* idx, VectorElem_t key);
+static bool   indexRehash  (VectorIndex* idx, size_t newCapacity);
+
+static size_t indexHashCalc(VectorElem_t key)
+{
+    uint64_t x = (uintptr_t)key;   // pointers are aligned, so mix the bits well
+
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDu;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53u;
+    x ^= x >> 33;
+
+    return x;
+}
+
+static size_t indexSlotFind(const VectorIndex* idx, VectorElem_t key)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    size_t mask = idx->capacity - 1;
+    size_t slot = indexHashCalc(key) & mask;
+
+    while (idx->entries[slot].count != 0 && idx->entries[slot].key != key) // table is never full
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+static bool indexRehash(VectorIndex* idx, size_t newCapacity)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    VectorIndexEntry* newEntries = (VectorIndexEntry*)calloc(newCapacity, sizeof(VectorIndexEntry));
+    if (!newEntries)
+        return false;
+
+    VectorIndexEntry* oldEntries  = idx->entries;
+    size_t            oldCapacity = idx->capacity;
+
+    idx->entries  = newEntries;
+    idx->capacity = newCapacity;
+
+    for (size_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldEntries[i].count != 0)
+            idx->entries[indexSlotFind(idx, oldEntries[i].key)] = oldEntries[i];
+    }
+
+    free(oldEntries);
+    return true;
+}
+
+bool indexCtor(VectorIndex* idx, size_t keys)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    memset(idx, 0, sizeof(*idx));
+
+    size_t capacity = INDEX_START_SIZE;
+    while (keys * INDEX_LOAD_DEN > capacity * INDEX_LOAD_NUM)
+        capacity *= 2;
+
+    idx->entries = (VectorIndexEntry*)calloc(capacity, sizeof(VectorIndexEntry));
+    if (!idx->entries)
+        return false;
+
+    idx->capacity = capacity;
+    return true;
+}
+
+void indexDtor(VectorIndex* idx)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    FREE(idx->entries);
+    memset(idx, 0, sizeof(*idx));
+}
+
+bool indexReserve(VectorIndex* idx, size_t keys)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    if (keys * INDEX_LOAD_DEN <= idx->capacity * INDEX_LOAD_NUM)
+        return true;
+
+    size_t newCapacity = idx->capacity * 2;
+    while (keys * INDEX_LOAD_DEN > newCapacity * INDEX_LOAD_NUM)
+        newCapacity *= 2;
+
+    return indexRehash(idx, newCapacity);
+}
+
+void indexInsert(VectorIndex* idx, VectorElem_t key, size_t pos) // room must be reserved by indexReserve
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    VectorIndexEntry* entry = &idx->entries[indexSlotFind(idx, key)];
+
+    if (entry->count == 0)
+    {
+        entry->key      = key;
+        entry->firstPos = pos;
+        idx->used++;
+    }
+    else if (pos < entry->firstPos)
+        entry->firstPos = pos;
+
+    entry->count++;
+    idx->elemCount++;
+}
+
+void indexErase(VectorIndex* idx, VectorElem_t key) // removes the last occurrence of key
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    size_t hole = indexSlotFind(idx, key);
+    if (idx->entries[hole].count == 0)
+        return;
+
+    idx->elemCount--;
+    if (--idx->entries[hole].count != 0)
+        return;
+
+    idx->used--;
+
+    size_t mask = idx->capacity - 1;   // backward shift deletion, so no tombstones are needed
+    size_t next = hole;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (idx->entries[next].count == 0)
+            break;
+
+        size_t home = indexHashCalc(idx->entries[next].key) & mask;
+        bool   stay = (hole <= next) ? (hole < home && home <= next)
+                                     : (hole < home || home <= next);
+        if (!stay)
+        {
+            idx->entries[hole] = idx->entries[next];
+            hole = next;
+        }
+    }
+
+    memset(&idx->entries[hole], 0, sizeof(VectorIndexEntry));
+}
+
+const VectorIndexEntry* indexFind(const VectorIndex* idx, VectorElem_t key)
+{
+    V_DBG(ASSERT(idx, "idx = nullptr", stderr);)
+
+    const VectorIndexEntry* entry = &idx->entries[indexSlotFind(idx, key)];
+    return entry->count != 0 ? entry : nullptr;
+}
+
+size_t indexMemory(const VectorIndex* idx)
+{
+    if (!idx)
+        return 0;
+
+    return sizeof(*idx) + idx->capacity * sizeof(VectorIndexEntry);
+}